@@ -1,10 +1,42 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
 
 // Constants for File Names ---
 #define profile_file "user_data.csv"
 #define report_file "health_index.txt"
+#define ranking_file "risk_ranking.txt"
+#define history_file "user_history.txt"
+#define store_file "user_data.store"
+#define results_file "health_results.col"
+
+// Population Ranking Limits ---
+#define MAX_RANK_THREADS 64
+
+// External Sort Limits ---
+#define MIN_SORT_BUDGET (1024 * 1024)   // Smallest accepted memory budget (bytes)
+#define MERGE_BLOCK_BYTES (64 * 1024)   // Smallest read block per run while merging
+
+// Shared Profile Store Limits ---
+#define STORE_MAGIC 0x48455053u         // "HEPS"
+#define STORE_VERSION 1                 // Bump when SharedProfiles changes
+#define STORE_SLOTS 4096                // Profiles the store can hold
+#define STORE_READ_RETRIES 100000       // Give up a snapshot after this many torn reads
+
+// Columnar Results Format ---
+#define RESULTS_MAGIC 0x48455243u       // "HERC"
+#define RESULTS_VERSION 1
+#define RESULTS_FLAG_RLE 1u             // Status column stored as runs
+#define BMI_SCALE 100.0f                // BMI fixed point: hundredths
 
 // --- Structure Definitions ---
 // HealthData: Stores the calculated BMI and status codes based on the analysis
@@ -32,12 +64,84 @@ typedef struct {
     HealthData analysis;
 } Profile;
 
+// ProfileSlot: One profile in the shared store, guarded by a seqlock.
+// seq is odd while a writer is copying data in; readers retry until they see
+// the same even value before and after their copy.
+typedef struct {
+    atomic_uint seq;
+    Profile data;
+} ProfileSlot;
+
+// SharedProfiles: Layout of the memory-mapped store file.
+typedef struct {
+    atomic_uint magic;   // Published last, with release, once the header is set
+    unsigned version;        // STORE_VERSION of the build that created the file
+    unsigned profile_size;   // sizeof(Profile) of that build
+    unsigned slot_count;     // STORE_SLOTS of that build
+    atomic_int count;    // Slots in use
+    atomic_int active;   // Slot written most recently (-1 if none)
+    ProfileSlot slots[STORE_SLOTS];
+} SharedProfiles;
+
+// ProfileStore: Per-process handle to the mapped store.
+typedef struct {
+    int fd;
+    SharedProfiles *map;
+} ProfileStore;
+
+// ResultsFooter: Last bytes of a results file; locates every column.
+// Columns are raw arrays, so a mapped file is read in place.
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t flags;
+    uint32_t run_count;      // Status runs (RLE only)
+    uint64_t rows;
+    uint64_t bmi_offset;     // uint16_t[rows], BMI * BMI_SCALE
+    uint64_t status_offset;  // 12 bits per row, or uint16_t[run_count] codes (RLE)
+    uint64_t run_offset;     // uint32_t[run_count], exclusive end row of each run (RLE)
+} ResultsFooter;
+
+// ResultsView: A mapped results file with pointers into its columns.
+typedef struct {
+    const unsigned char *base;
+    size_t size;
+    ResultsFooter footer;
+    const uint16_t *bmi;
+    const unsigned char *status;
+    const uint32_t *run_ends;
+} ResultsView;
+
+// Reading: One timestamped profile line from a raw reading dump.
+typedef struct {
+    long long ts;
+    Profile p;
+} Reading;
+
 // Function prototypes
 HealthData analyzeData(float weight, float height, float bp_sys, float bp_dias, float bs, float chol, int chol_type, int hrs);
-void saveProfile(Profile p);
+int saveProfile(Profile p);
 int loadProfile(Profile* p);
+int openProfileStore(ProfileStore *st, const char *path);
+int openProfileStoreReadOnly(ProfileStore *st, const char *path);
+void closeProfileStore(ProfileStore *st);
+int storeSaveProfile(ProfileStore *st, const Profile *p, int set_active);
+int storeLoadProfile(ProfileStore *st, const char *name, Profile *out);
+int importToStore(const char *path);
+int writeResultsFile(const char *path, const HealthData *rows, size_t count, int rle);
+int openResultsFile(ResultsView *v, const char *path);
+void closeResultsFile(ResultsView *v);
+HealthData resultsRow(const ResultsView *v, size_t i);
+void resultsStatusCounts(const ResultsView *v, uint64_t counts[4][8]);
+int exportResults(const char *path, int rle);
+int printResultsSummary(void);
 void dietAddAvoid(HealthData data, FILE *fp);
 void exerciseAddAvoid(HealthData data, FILE *fp);
+int loadPopulation(const char *path, Profile **out);
+float riskScore(const Profile *p);
+int rankPopulation(const Profile *pop, int count, int k, int threads, int *out_idx, float *out_score);
+int writeRiskRanking(const char *path, int k, int threads);
+int groupReadings(const char *dump_path, const char *out_path, size_t budget);
 
 // Global Constant Arrays (for Labels) ---
 // BMI Status Labels 
@@ -91,38 +195,274 @@ const char *const cholType_labels[] = {
     "Triglycerides"
 };
 
+// SHARED PROFILE STORE
+// Several processes map the same store file. Writers serialize among themselves
+// with flock(); readers open the file read-only, take no lock at all and copy
+// a slot under its seqlock, so a writer can never block them and readers never
+// write shared memory.
+
+// A store written by a build with a different Profile or slot count would be
+// misread, so the header records the layout next to the magic.
+static int storeLayoutOk(const SharedProfiles *m) {
+    return m->version == STORE_VERSION && m->profile_size == sizeof(Profile) &&
+           m->slot_count == STORE_SLOTS;
+}
+
+// Maps an already-sized store file with the given protection.
+// Returns 1 if it holds an initialized store with this build's layout.
+static int mapProfileStore(ProfileStore *st, int prot) {
+    off_t size = lseek(st->fd, 0, SEEK_END);
+    if (size < (off_t)sizeof(SharedProfiles)) return 0;
+
+    void* map = mmap(NULL, sizeof(SharedProfiles), prot, MAP_SHARED, st->fd, 0);
+    if (map == MAP_FAILED) return 0;
+    st->map = map;
+
+    // Acquire pairs with the release store that publishes magic
+    return atomic_load_explicit(&st->map->magic, memory_order_acquire) == STORE_MAGIC &&
+           storeLayoutOk(st->map);
+}
+
+// Opens (creating if needed) and maps the store for writing. Returns 1 on success.
+// Only the first open of a new file takes the writer lock, to initialize it.
+int openProfileStore(ProfileStore *st, const char *path) {
+    st->fd = open(path, O_RDWR | O_CREAT, 0644);
+    st->map = NULL;
+    if (st->fd < 0) return 0;
+    if (mapProfileStore(st, PROT_READ | PROT_WRITE)) return 1;
+
+    // Size and initialize under the writer lock so two processes don't race
+    int ok = flock(st->fd, LOCK_EX) == 0;
+    if (ok && !st->map) {
+        off_t size = lseek(st->fd, 0, SEEK_END);
+        if (size != 0 && size < (off_t)sizeof(SharedProfiles)) ok = 0; // Not a new file; not ours either
+        else if (size == 0) ok = ftruncate(st->fd, sizeof(SharedProfiles)) == 0;
+        if (ok) {
+            mapProfileStore(st, PROT_READ | PROT_WRITE);
+            ok = st->map != NULL;
+        }
+    }
+    if (ok && atomic_load_explicit(&st->map->magic, memory_order_relaxed) != STORE_MAGIC) {
+        // New file: it is already zero-filled, so only the header needs setting
+        atomic_store_explicit(&st->map->count, 0, memory_order_relaxed);
+        atomic_store_explicit(&st->map->active, -1, memory_order_relaxed);
+        st->map->version = STORE_VERSION;
+        st->map->profile_size = sizeof(Profile);
+        st->map->slot_count = STORE_SLOTS;
+        atomic_store_explicit(&st->map->magic, STORE_MAGIC, memory_order_release);
+    }
+    if (ok && !storeLayoutOk(st->map)) ok = 0; // Store from an incompatible build
+    flock(st->fd, LOCK_UN);
+
+    if (!ok) closeProfileStore(st);
+    return ok;
+}
+
+// Opens and maps an existing, initialized store read-only: no create, no
+// init, no lock. Works for workers without write access. Returns 1 on success.
+int openProfileStoreReadOnly(ProfileStore *st, const char *path) {
+    st->fd = open(path, O_RDONLY);
+    st->map = NULL;
+    if (st->fd < 0) return 0;
+    if (mapProfileStore(st, PROT_READ)) return 1;
+
+    closeProfileStore(st);
+    return 0;
+}
+
+void closeProfileStore(ProfileStore *st) {
+    if (st->map) munmap(st->map, sizeof(SharedProfiles));
+    if (st->fd >= 0) close(st->fd);
+    st->map = NULL;
+    st->fd = -1;
+}
+
+// Copies a consistent snapshot of one slot without locking. Returns 0 if a
+// writer kept the slot busy for STORE_READ_RETRIES attempts.
+static int readSlot(ProfileSlot *slot, Profile *out) {
+    for (int tries = 0; tries < STORE_READ_RETRIES; tries++) {
+        unsigned before = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        if (before & 1) {
+            sched_yield(); // Writer mid-copy
+            continue;
+        }
+        memcpy(out, &slot->data, sizeof(Profile));
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(&slot->seq, memory_order_relaxed) == before) return 1;
+    }
+    return 0;
+}
+
+// Publishes p into a slot. Caller must hold the writer lock.
+static void writeSlot(ProfileSlot *slot, const Profile *p) {
+    unsigned seq = atomic_load_explicit(&slot->seq, memory_order_relaxed);
+    if (seq & 1) seq++; // A previous writer died mid-copy; finish its cycle
+    atomic_store_explicit(&slot->seq, seq + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    memcpy(&slot->data, p, sizeof(Profile));
+    atomic_store_explicit(&slot->seq, seq + 2, memory_order_release);
+}
+
+// Inserts or replaces the profile with p's name, marking it active if
+// set_active is set. Caller must hold the writer lock. Returns 0 if the store is full.
+static int storeSaveLocked(ProfileStore *st, const Profile *p, int set_active) {
+    SharedProfiles *m = st->map;
+    int count = atomic_load_explicit(&m->count, memory_order_relaxed);
+    if (count < 0 || count > STORE_SLOTS) return 0; // Corrupt header
+    int slot = -1;
+    for (int i = 0; i < count; i++) {
+        // Only writers change slot data and we hold the lock, so read directly
+        if (strcmp(m->slots[i].data.name, p->name) == 0) {
+            slot = i;
+            break;
+        }
+    }
+    if (slot < 0 && count < STORE_SLOTS) slot = count;
+
+    if (slot >= 0) {
+        writeSlot(&m->slots[slot], p);
+        if (slot == count) atomic_store_explicit(&m->count, count + 1, memory_order_release);
+        if (set_active) atomic_store_explicit(&m->active, slot, memory_order_release);
+    }
+    return slot >= 0;
+}
+
+// Locked wrapper around storeSaveLocked(). Only the tracker's own save should
+// set_active; bulk loads leave the active profile alone.
+// Returns 1 on success, 0 if the store is full or the lock failed.
+int storeSaveProfile(ProfileStore *st, const Profile *p, int set_active) {
+    if (flock(st->fd, LOCK_EX) != 0) return 0;
+    int ok = storeSaveLocked(st, p, set_active);
+    flock(st->fd, LOCK_UN);
+    return ok;
+}
+
+// Snapshot of the named profile, or of the active one when name is NULL.
+// Lock-free and works on a read-only handle; returns 1 if found.
+int storeLoadProfile(ProfileStore *st, const char *name, Profile *out) {
+    SharedProfiles *m = st->map;
+
+    if (name == NULL) {
+        int active = atomic_load_explicit(&m->active, memory_order_acquire);
+        return active >= 0 && active < STORE_SLOTS && readSlot(&m->slots[active], out);
+    }
+
+    // count comes from a shared file; never trust it past the mapping
+    int count = atomic_load_explicit(&m->count, memory_order_acquire);
+    if (count > STORE_SLOTS) count = STORE_SLOTS;
+    for (int i = 0; i < count; i++) {
+        // Slots are never reused for another name, so a name check on a
+        // snapshot is enough even if the slot is rewritten afterwards
+        if (readSlot(&m->slots[i], out) && strcmp(out->name, name) == 0) return 1;
+    }
+    return 0;
+}
+
+// Loads every profile in a CSV (user_data.csv layout) into the store without
+// changing which profile is active.
+int importToStore(const char *path) {
+    Profile* pop = NULL;
+    int count = loadPopulation(path, &pop);
+    if (count < 0) {
+        printf("Error: Could not open population file %s.\n", path);
+        return 0;
+    }
+
+    ProfileStore st;
+    if (!openProfileStore(&st, store_file)) {
+        printf("Error: Could not open profile store %s.\n", store_file);
+        free(pop);
+        return 0;
+    }
+
+    int saved = 0;
+    for (int i = 0; i < count; i++) saved += storeSaveProfile(&st, &pop[i], 0);
+    closeProfileStore(&st);
+    free(pop);
+
+    printf("\n[SUCCESS] %d of %d profile(s) imported into %s\n", saved, count, store_file);
+    return saved == count;
+}
+
 // SAVE PROFILE TO CSV
-void saveProfile(Profile p) {
-    FILE* file = fopen(profile_file, "w"); // Open file in write mode ("w")
+// Replaces the CSV atomically (write a private temp file, then rename), then
+// publishes to the shared store, all under the store's writer lock so
+// concurrent savers can't interleave and CSV readers never see a partial file.
+// The store must never disagree with the CSV: if the store can't be opened or
+// locked nothing is saved, and if it is full the active profile is cleared so
+// loadProfile() falls back to the CSV. Returns 1 on success.
+int saveProfile(Profile p) {
+    ProfileStore st;
+    if (!openProfileStore(&st, store_file) || flock(st.fd, LOCK_EX) != 0) {
+        printf("Error: Could not open profile store for saving.\n");
+        closeProfileStore(&st);
+        return 0;
+    }
+
+    int ok = 0;
+    char tmp_name[] = profile_file ".XXXXXX";
+    int fd = mkstemp(tmp_name); // Unique temp file next to the CSV
+    FILE* file = (fd >= 0) ? fdopen(fd, "w") : NULL; // Open temp file in write mode ("w")
     if (!file) {
         printf("Error: Could not open profile file for saving.\n");
-        return;
+        if (fd >= 0) {
+            close(fd);
+            unlink(tmp_name);
+        }
+    } else {
+        fchmod(fd, 0644); // mkstemp creates 0600; keep the CSV readable by other workers
+
+        // Corrected fprintf: writes all values as a single, comma-separated line.
+        fprintf(file, "%s, %d, %.2f, %.2f, %.2f, %.2f, %.2f, %.2f, %d, %d\n",
+            p.name, p.age, p.weight, p.height, p.bp_sys, p.bp_dias, 
+            p.bs, p.chol, p.chol_type, p.hrs);
+
+        if (fclose(file) != 0 || rename(tmp_name, profile_file) != 0) {
+            printf("Error: Could not save profile file.\n");
+            unlink(tmp_name);
+        } else {
+            ok = 1;
+        }
     }
 
-    // Corrected fprintf: writes all values as a single, comma-separated line.
-    fprintf(file, "%s, %d, %.2f, %.2f, %.2f, %.2f, %.2f, %.2f, %d, %d\n",
-        p.name, p.age, p.weight, p.height, p.bp_sys, p.bp_dias, 
-        p.bs, p.chol, p.chol_type, p.hrs);
+    // Only publish once the CSV holds the new profile
+    if (ok && !storeSaveLocked(&st, &p, 1)) {
+        printf("Warning: Profile store is full; %s holds the saved profile.\n", profile_file);
+        atomic_store_explicit(&st.map->active, -1, memory_order_release);
+    }
 
-    fclose(file);
+    flock(st.fd, LOCK_UN);
+    closeProfileStore(&st);
+    return ok;
 }
 
-// LOAD PROFILE FROM CSV
+// LOAD PROFILE
+// Reads a lock-free snapshot of the active profile from the shared store,
+// falling back to the CSV when the store has none (or it was full on save).
 int loadProfile(Profile* p) { 
-    FILE* file = fopen(profile_file, "r"); 
-    if (!file) return 0;
+    ProfileStore st;
+    int found = 0;
+    if (openProfileStoreReadOnly(&st, store_file)) {
+        found = storeLoadProfile(&st, NULL, p);
+        closeProfileStore(&st);
+    }
+
+    if (!found) {
+        FILE* file = fopen(profile_file, "r"); 
+        if (!file) return 0;
+
+        if (fscanf(file, "%49[^,], %d, %f, %f, %f, %f, %f, %f, %d, %d",
+                    p->name, &p->age, &p->weight, &p->height,
+                    &p->bp_sys, &p->bp_dias, &p->bs, &p->chol, 
+                    &p->chol_type, &p->hrs) != 10) {
+            
+            fclose(file);
+            return 0; // Failed to read all 10 items
+        }
 
-    if (fscanf(file, "%49[^,], %d, %f, %f, %f, %f, %f, %f, %d, %d",
-                p->name, &p->age, &p->weight, &p->height,
-                &p->bp_sys, &p->bp_dias, &p->bs, &p->chol, 
-                &p->chol_type, &p->hrs) != 10) {
-        
         fclose(file);
-        return 0; // Failed to read all 10 items
     }
 
-    fclose(file);
-
     // ... The rest of the function remains the same ...
     p->analysis = analyzeData(
         p->weight, p->height,
@@ -280,6 +620,696 @@ HealthData analyzeData(float weight, float height, float bp_sys, float bp_dias,
     return data;
 }
 
+// POPULATION LOADER
+// Reads every line of a profile CSV (same layout as user_data.csv) and analyzes it.
+// Returns the number of profiles loaded, or -1 on error. Caller frees *out.
+int loadPopulation(const char *path, Profile **out) {
+    FILE* file = fopen(path, "r");
+    if (!file) return -1;
+
+    int cap = 256;
+    int count = 0;
+    Profile* pop = malloc(cap * sizeof(Profile));
+    char line[256];
+
+    while (pop && fgets(line, sizeof(line), file) != NULL) {
+        Profile p;
+        if (sscanf(line, "%49[^,], %d, %f, %f, %f, %f, %f, %f, %d, %d",
+                   p.name, &p.age, &p.weight, &p.height,
+                   &p.bp_sys, &p.bp_dias, &p.bs, &p.chol,
+                   &p.chol_type, &p.hrs) != 10) {
+            continue; // Skip malformed lines
+        }
+        p.analysis = analyzeData(p.weight, p.height, p.bp_sys, p.bp_dias,
+                                 p.bs, p.chol, p.chol_type, p.hrs);
+
+        if (count == cap) {
+            Profile* grown = realloc(pop, cap * 2 * sizeof(Profile));
+            if (!grown) break;
+            pop = grown;
+            cap *= 2;
+        }
+        pop[count++] = p;
+    }
+
+    fclose(file);
+    if (!pop) return -1;
+    *out = pop;
+    return count;
+}
+
+// RISK SCORE FUNCTION
+// Composite outreach score. Only Hypertensive Crisis, Dangerously High sugar and
+// High Risk cholesterol count; each adds 1 plus how far (as a fraction) the
+// reading is past that status cutoff. A score of 0 means no outreach needed.
+float riskScore(const Profile *p) {
+    float score = 0.0f;
+
+    // BP: Hypertensive Crisis starts at 180 systolic or 120 diastolic
+    if (p->analysis.bp_status == 5) {
+        float sys_over = (p->bp_sys - 180.0f) / 180.0f;
+        float dias_over = (p->bp_dias - 120.0f) / 120.0f;
+        score += 1.0f + (sys_over > dias_over ? sys_over : dias_over);
+    }
+
+    // Blood Sugar: Dangerously High cutoff depends on time since last meal
+    if (p->analysis.bs_status == 4) {
+        float cutoff = (p->hrs == 1) ? 300.0f : (p->hrs == 2) ? 220.0f : 180.0f;
+        score += 1.0f + (p->bs - cutoff) / cutoff;
+    }
+
+    // Cholesterol: High Risk cutoff depends on type (HDL is risky when low)
+    if (p->analysis.chol_status == 2) {
+        if (p->chol_type == 3) {
+            score += 1.0f + (50.0f - p->chol) / 50.0f;
+        } else {
+            float cutoff = (p->chol_type == 1) ? 240.0f : (p->chol_type == 2) ? 160.0f : 200.0f;
+            score += 1.0f + (p->chol - cutoff) / cutoff;
+        }
+    }
+
+    return score;
+}
+
+// BOUNDED MIN-HEAP (top-K helper)
+// Keeps the K highest scores seen; the root is the lowest of them, so a new
+// candidate only has to beat heap[0] to get in.
+typedef struct {
+    float score;
+    int idx;
+} RiskEntry;
+
+// Heap order: lower score first; equal scores put the later row first, so
+// ties always resolve to the earlier row regardless of thread count.
+static int riskLess(RiskEntry a, RiskEntry b) {
+    return a.score < b.score || (a.score == b.score && a.idx > b.idx);
+}
+
+static void heapSiftDown(RiskEntry *heap, int size, int i) {
+    while (1) {
+        int l = 2 * i + 1, r = l + 1, min = i;
+        if (l < size && riskLess(heap[l], heap[min])) min = l;
+        if (r < size && riskLess(heap[r], heap[min])) min = r;
+        if (min == i) return;
+        RiskEntry t = heap[i]; heap[i] = heap[min]; heap[min] = t;
+        i = min;
+    }
+}
+
+static void heapSiftUp(RiskEntry *heap, int i) {
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!riskLess(heap[i], heap[parent])) return;
+        RiskEntry t = heap[i]; heap[i] = heap[parent]; heap[parent] = t;
+        i = parent;
+    }
+}
+
+static void heapOffer(RiskEntry *heap, int *size, int k, RiskEntry e) {
+    if (*size < k) {
+        heap[*size] = e;
+        heapSiftUp(heap, (*size)++);
+    } else if (riskLess(heap[0], e)) {
+        heap[0] = e;
+        heapSiftDown(heap, k, 0);
+    }
+}
+
+// Per-thread work: scores a slice of the population into its own heap.
+typedef struct {
+    const Profile *pop;
+    int begin, end, k;
+    RiskEntry *heap;
+    int size;
+} RankTask;
+
+static void *rankWorker(void *arg) {
+    RankTask *t = arg;
+    for (int i = t->begin; i < t->end; i++) {
+        RiskEntry e = { riskScore(&t->pop[i]), i };
+        if (e.score > 0.0f) heapOffer(t->heap, &t->size, t->k, e);
+    }
+    return NULL;
+}
+
+// RANKING FUNCTION
+// Finds the K highest-risk profiles without sorting the population: each thread
+// keeps a bounded heap over its slice, the heaps are merged, and only the final
+// K entries are ordered. Fills out_idx/out_score (highest first) and returns how
+// many were found (fewer than K if fewer users are at risk), or -1 on error.
+int rankPopulation(const Profile *pop, int count, int k, int threads, int *out_idx, float *out_score) {
+    if (k <= 0 || count <= 0) return 0;
+    if (k > count) k = count; // Heaps never need more room than there are users
+    if (threads < 1) threads = 1;
+    if (threads > MAX_RANK_THREADS) threads = MAX_RANK_THREADS;
+    if (threads > count) threads = count;
+
+    RankTask tasks[MAX_RANK_THREADS];
+    pthread_t ids[MAX_RANK_THREADS];
+    int running[MAX_RANK_THREADS];
+    // Each worker heap only needs min(k, slice) entries, so all of them together
+    // never exceed the population; only the merge heap needs the full k
+    int chunk = (count + threads - 1) / threads;
+    size_t total = k;
+    for (int t = 0; t < threads; t++) {
+        tasks[t].pop = pop;
+        tasks[t].begin = t * chunk < count ? t * chunk : count;
+        tasks[t].end = (t + 1) * chunk < count ? (t + 1) * chunk : count;
+        int slice = tasks[t].end - tasks[t].begin;
+        tasks[t].k = k < slice ? k : slice;
+        tasks[t].size = 0;
+        total += tasks[t].k;
+    }
+
+    RiskEntry *heaps = malloc(total * sizeof(RiskEntry));
+    if (!heaps) return -1;
+
+    RiskEntry *next = heaps;
+    for (int t = 0; t < threads; t++) {
+        tasks[t].heap = next;
+        next += tasks[t].k;
+        // Fall back to running the slice inline if a thread can't be created
+        running[t] = (t > 0 && pthread_create(&ids[t], NULL, rankWorker, &tasks[t]) == 0);
+        if (t > 0 && !running[t]) rankWorker(&tasks[t]);
+    }
+    rankWorker(&tasks[0]); // Main thread takes the first slice
+    for (int t = 1; t < threads; t++) {
+        if (running[t]) pthread_join(ids[t], NULL);
+    }
+
+    // Merge the per-thread heaps into one final bounded heap
+    RiskEntry *final = next;
+    int size = 0;
+    for (int t = 0; t < threads; t++) {
+        for (int i = 0; i < tasks[t].size; i++) {
+            heapOffer(final, &size, k, tasks[t].heap[i]);
+        }
+    }
+
+    // Pop min repeatedly, filling the output from the back (highest first)
+    int found = size;
+    for (int i = found - 1; i >= 0; i--) {
+        out_idx[i] = final[0].idx;
+        out_score[i] = final[0].score;
+        final[0] = final[--size];
+        heapSiftDown(final, size, 0);
+    }
+
+    free(heaps);
+    return found;
+}
+
+// RANKING REPORT
+// Ranks every profile in the given CSV and writes the top K to ranking_file.
+int writeRiskRanking(const char *path, int k, int threads) {
+    if (k <= 0) {
+        printf("Error: Number of users to rank must be a positive number.\n");
+        return 0;
+    }
+
+    Profile* pop = NULL;
+    int count = loadPopulation(path, &pop);
+    if (count < 0) {
+        printf("Error: Could not open population file %s.\n", path);
+        return 0;
+    }
+    if (k > count) k = count;
+
+    int* idx = malloc((k > 0 ? k : 1) * sizeof(int));
+    float* score = malloc((k > 0 ? k : 1) * sizeof(float));
+    int found = (idx && score) ? rankPopulation(pop, count, k, threads, idx, score) : -1;
+    if (found < 0) {
+        printf("Error: Not enough memory to rank population.\n");
+        free(idx); free(score); free(pop);
+        return 0;
+    }
+
+    FILE* fp = fopen(ranking_file, "w");
+    if (!fp) fp = stdout;
+
+    fprintf(fp, "TOP %d HIGHEST-RISK USERS (of %d)\n", found, count);
+    fprintf(fp, "==============================\n");
+    for (int i = 0; i < found; i++) {
+        const Profile *p = &pop[idx[i]];
+        fprintf(fp, "%d. %s (Score: %.2f) BP: %s | Sugar: %s | Cholesterol: %s\n",
+                i + 1, p->name, score[i],
+                bp_labels[p->analysis.bp_status],
+                bs_labels[p->analysis.bs_status],
+                chol_labels[p->analysis.chol_status]);
+    }
+
+    if (fp != stdout) fclose(fp);
+    printf("\n[SUCCESS] Risk ranking of %d user(s) generated in %s\n", found, ranking_file);
+
+    free(idx); free(score); free(pop);
+    return 1;
+}
+
+// EXTERNAL SORT HELPERS
+// Orders readings by user name, then by time.
+static int readingCmp(const void *a, const void *b) {
+    const Reading *x = a, *y = b;
+    int c = strcmp(x->p.name, y->p.name);
+    if (c != 0) return c;
+    return (x->ts > y->ts) - (x->ts < y->ts);
+}
+
+// Spill file on local disk. Unbuffered because runs are read/written in our own blocks.
+static FILE *openRunFile(void) {
+    FILE* fp = tmpfile();
+    if (fp) setvbuf(fp, NULL, _IONBF, 0);
+    return fp;
+}
+
+// Sequential reader over one sorted run, refilled one block at a time.
+typedef struct {
+    FILE *fp;
+    Reading *buf;
+    size_t cap, len, pos;
+} RunReader;
+
+static int runHasNext(RunReader *r) {
+    if (r->pos < r->len) return 1;
+    r->len = fread(r->buf, sizeof(Reading), r->cap, r->fp);
+    r->pos = 0;
+    return r->len > 0;
+}
+
+static void runSiftDown(RunReader *rd, int *heap, int size, int i) {
+    while (1) {
+        int l = 2 * i + 1, r = l + 1, min = i;
+        if (l < size && readingCmp(&rd[heap[l]].buf[rd[heap[l]].pos], &rd[heap[min]].buf[rd[heap[min]].pos]) < 0) min = l;
+        if (r < size && readingCmp(&rd[heap[r]].buf[rd[heap[r]].pos], &rd[heap[min]].buf[rd[heap[min]].pos]) < 0) min = r;
+        if (min == i) return;
+        int t = heap[i]; heap[i] = heap[min]; heap[min] = t;
+        i = min;
+    }
+}
+
+// Writes one merged reading: binary into the next run, or evaluated text into the report.
+static int emitReading(const Reading *r, FILE *out_run, Reading *out_buf, size_t out_cap,
+                       size_t *out_len, FILE *report, char *last_name) {
+    if (out_run) {
+        out_buf[(*out_len)++] = *r;
+        if (*out_len == out_cap) {
+            if (fwrite(out_buf, sizeof(Reading), *out_len, out_run) != *out_len) return 0;
+            *out_len = 0;
+        }
+        return 1;
+    }
+
+    const Profile *p = &r->p;
+    HealthData d = analyzeData(p->weight, p->height, p->bp_sys, p->bp_dias,
+                               p->bs, p->chol, p->chol_type, p->hrs);
+    if (strcmp(last_name, p->name) != 0) {
+        fprintf(report, "\n=== %s ===\n", p->name);
+        strcpy(last_name, p->name);
+    }
+    fprintf(report, "[%lld] BMI: %.2f (%s) | BP: %.0f/%.0f (%s) | Sugar: %.0f (%s) | Cholesterol: %.0f (%s)\n",
+            r->ts, d.bmi, bmi_labels[d.bmi_status],
+            p->bp_sys, p->bp_dias, bp_labels[d.bp_status],
+            p->bs, bs_labels[d.bs_status],
+            p->chol, chol_labels[d.chol_status]);
+    return 1;
+}
+
+// K-way merge of sorted runs using mem (mem_count readings) as block buffers.
+// Output goes to out_run as a new sorted run, or to report when out_run is NULL.
+static int mergeRuns(FILE **runs, int n, Reading *mem, size_t mem_count, FILE *out_run, FILE *report) {
+    RunReader* rd = malloc(n * sizeof(RunReader));
+    int* heap = malloc(n * sizeof(int));
+    if (!rd || !heap) { free(rd); free(heap); return 0; }
+
+    size_t block = mem_count / (n + 1);
+    int size = 0;
+    for (int i = 0; i < n; i++) {
+        rewind(runs[i]);
+        rd[i].fp = runs[i];
+        rd[i].buf = mem + (size_t)i * block;
+        rd[i].cap = block;
+        rd[i].len = rd[i].pos = 0;
+        if (runHasNext(&rd[i])) heap[size++] = i;
+    }
+    for (int i = size / 2 - 1; i >= 0; i--) runSiftDown(rd, heap, size, i);
+
+    Reading *out_buf = mem + (size_t)n * block;
+    size_t out_len = 0;
+    char last_name[50] = "";
+    int ok = 1;
+
+    while (size > 0 && ok) {
+        RunReader *top = &rd[heap[0]];
+        ok = emitReading(&top->buf[top->pos], out_run, out_buf, block, &out_len, report, last_name);
+        top->pos++;
+        if (!runHasNext(top)) heap[0] = heap[--size];
+        runSiftDown(rd, heap, size, 0);
+    }
+    if (ok && out_run && out_len > 0) {
+        ok = fwrite(out_buf, sizeof(Reading), out_len, out_run) == out_len;
+    }
+
+    free(rd);
+    free(heap);
+    return ok;
+}
+
+// GROUPING FUNCTION
+// Rebuilds per-user history from a raw reading dump that may not fit in memory.
+// Each dump line is "timestamp, <profile csv fields>". Readings are sorted in
+// runs of at most `budget` bytes, spilled to temp files, then k-way merged
+// (in several passes if there are too many runs for one) so out_path lists each
+// user's readings in time order with their evaluation. Returns 1 on success.
+int groupReadings(const char *dump_path, const char *out_path, size_t budget) {
+    if (budget < MIN_SORT_BUDGET) budget = MIN_SORT_BUDGET;
+
+    FILE* dump = fopen(dump_path, "r");
+    if (!dump) {
+        printf("Error: Could not open reading dump %s.\n", dump_path);
+        return 0;
+    }
+
+    // Reserve an eighth of the budget for run bookkeeping and stdio buffers
+    size_t mem_count = (budget - budget / 8) / sizeof(Reading);
+    Reading* mem = malloc(mem_count * sizeof(Reading));
+    int run_cap = 16, run_count = 0;
+    FILE** runs = malloc(run_cap * sizeof(FILE*));
+    int ok = (mem && runs);
+
+    // Pass 1: fill memory, sort, spill a run, repeat
+    char line[256];
+    size_t len = 0;
+    int more = 1;
+    while (ok && more) {
+        more = fgets(line, sizeof(line), dump) != NULL;
+        if (more) {
+            Reading* r = &mem[len];
+            if (sscanf(line, "%lld, %49[^,], %d, %f, %f, %f, %f, %f, %f, %d, %d",
+                       &r->ts, r->p.name, &r->p.age, &r->p.weight, &r->p.height,
+                       &r->p.bp_sys, &r->p.bp_dias, &r->p.bs, &r->p.chol,
+                       &r->p.chol_type, &r->p.hrs) == 11) {
+                len++;
+            }
+        }
+        if (len == mem_count || (!more && len > 0)) {
+            qsort(mem, len, sizeof(Reading), readingCmp);
+            if (run_count == run_cap) {
+                FILE** grown = realloc(runs, run_cap * 2 * sizeof(FILE*));
+                if (!grown) { ok = 0; break; }
+                runs = grown;
+                run_cap *= 2;
+            }
+            FILE* run = openRunFile();
+            if (!run || fwrite(mem, sizeof(Reading), len, run) != len) {
+                if (run) fclose(run);
+                ok = 0;
+                break;
+            }
+            runs[run_count++] = run;
+            len = 0;
+        }
+    }
+    fclose(dump);
+
+    // Pass 2+: merge at most fan_in runs at a time until one final merge remains
+    int fan_in = (int)(mem_count * sizeof(Reading) / MERGE_BLOCK_BYTES) - 1;
+    if (fan_in < 2) fan_in = 2;
+    while (ok && run_count > fan_in) {
+        int merged = 0;
+        for (int i = 0; i < run_count; i += fan_in) {
+            int n = (run_count - i < fan_in) ? run_count - i : fan_in;
+            FILE* out = ok ? openRunFile() : NULL;
+            ok = out && mergeRuns(runs + i, n, mem, mem_count, out, NULL);
+            for (int j = 0; j < n; j++) fclose(runs[i + j]);
+            if (!ok && out) fclose(out);
+            else if (ok) runs[merged++] = out; // merged <= i, so no unread run is overwritten
+        }
+        run_count = merged;
+    }
+
+    if (ok) {
+        FILE* report = fopen(out_path, "w");
+        ok = report && mergeRuns(runs, run_count, mem, mem_count, NULL, report);
+        if (report) fclose(report);
+    }
+
+    for (int i = 0; i < run_count; i++) fclose(runs[i]);
+    free(runs);
+    free(mem);
+
+    if (ok) printf("\n[SUCCESS] Per-user history generated in %s\n", out_path);
+    else printf("Error: Could not group readings from %s.\n", dump_path);
+    return ok;
+}
+
+// COLUMNAR RESULTS FILE
+// Nightly results for a whole population: BMI as 16-bit fixed point and the
+// four status codes packed at 3 bits each (12 bits per row), optionally
+// run-length encoded. A footer at the end of the file holds column offsets.
+
+// Packs bmi/bp/bs/chol status into one 12-bit code.
+static uint16_t packStatus(const HealthData *d) {
+    return (uint16_t)((d->bmi_status & 7) | (d->bp_status & 7) << 3 |
+                      (d->bs_status & 7) << 6 | (d->chol_status & 7) << 9);
+}
+
+// Unpacks a 12-bit code. A 3-bit field can hold up to 7, so codes from a
+// corrupt file are clamped to the last label of each status array.
+static void unpackStatus(uint16_t code, HealthData *d) {
+    int bmi = code & 7, bp = (code >> 3) & 7, bs = (code >> 6) & 7, chol = (code >> 9) & 7;
+    d->bmi_status = bmi < 5 ? bmi : 5;
+    d->bp_status = bp < 5 ? bp : 5;
+    d->bs_status = bs < 4 ? bs : 4;
+    d->chol_status = chol < 2 ? chol : 2;
+}
+
+// Pads the file with zeros to the given alignment.
+static int padTo(FILE *fp, long align) {
+    static const char zeros[8] = {0};
+    long pos = ftell(fp);
+    if (pos < 0) return 0;
+    size_t pad = (align - pos % align) % align;
+    return fwrite(zeros, 1, pad, fp) == pad;
+}
+
+// Writes count evaluated rows to path. With rle, consecutive rows that share
+// all four status codes are stored as a single run. Returns 1 on success.
+int writeResultsFile(const char *path, const HealthData *rows, size_t count, int rle) {
+    if (count > UINT32_MAX) return 0; // Run ends are 32-bit; the reader rejects larger files
+
+    FILE* fp = fopen(path, "wb");
+    if (!fp) return 0;
+
+    ResultsFooter f = { RESULTS_MAGIC, RESULTS_VERSION, rle ? RESULTS_FLAG_RLE : 0, 0, count, 0, 0, 0 };
+    int ok = 1;
+
+    // BMI column
+    f.bmi_offset = 0;
+    for (size_t i = 0; ok && i < count; i++) {
+        float scaled = rows[i].bmi * BMI_SCALE + 0.5f;
+        uint16_t bmi = scaled <= 0.0f ? 0 : scaled >= 65535.0f ? 65535 : (uint16_t)scaled;
+        ok = fwrite(&bmi, sizeof(bmi), 1, fp) == 1;
+    }
+
+    if (!rle) {
+        // Status column: two rows per three bytes, plus one pad byte so a
+        // reader can always load 16 bits at a row's byte offset
+        ok = ok && padTo(fp, 8);
+        f.status_offset = ftell(fp);
+        for (size_t i = 0; ok && i < count; i += 2) {
+            uint16_t a = packStatus(&rows[i]);
+            uint16_t b = (i + 1 < count) ? packStatus(&rows[i + 1]) : 0;
+            unsigned char bytes[3] = { a & 0xFF, (a >> 8) | (b & 0x0F) << 4, b >> 4 };
+            ok = fwrite(bytes, 1, (i + 1 < count) ? 3 : 2, fp) == ((i + 1 < count) ? 3u : 2u);
+        }
+        ok = ok && fputc(0, fp) != EOF;
+    } else {
+        // Run ends column, then one status code per run
+        ok = ok && padTo(fp, 8);
+        f.run_offset = ftell(fp);
+        for (size_t i = 0; ok && i < count; ) {
+            uint16_t code = packStatus(&rows[i]);
+            while (i < count && packStatus(&rows[i]) == code) i++;
+            uint32_t end = (uint32_t)i;
+            ok = fwrite(&end, sizeof(end), 1, fp) == 1;
+            f.run_count++;
+        }
+        f.status_offset = ftell(fp);
+        for (size_t i = 0; ok && i < count; ) {
+            uint16_t code = packStatus(&rows[i]);
+            while (i < count && packStatus(&rows[i]) == code) i++;
+            ok = fwrite(&code, sizeof(code), 1, fp) == 1;
+        }
+    }
+
+    ok = ok && padTo(fp, 8) && fwrite(&f, sizeof(f), 1, fp) == 1;
+    if (fclose(fp) != 0) ok = 0;
+    return ok;
+}
+
+// True if len bytes starting at off lie inside a body of the given size.
+// Checked separately so a huge off can't wrap the sum back into range.
+static int columnFits(uint64_t off, uint64_t len, uint64_t body) {
+    return off <= body && len <= body - off;
+}
+
+// Maps a results file read-only and points the view at its columns.
+// Returns 1 on success.
+int openResultsFile(ResultsView *v, const char *path) {
+    memset(v, 0, sizeof(*v));
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return 0;
+
+    off_t size = lseek(fd, 0, SEEK_END);
+    void* map = (size >= (off_t)sizeof(ResultsFooter))
+        ? mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0) : MAP_FAILED;
+    close(fd);
+    if (map == MAP_FAILED) return 0;
+
+    v->base = map;
+    v->size = size;
+    memcpy(&v->footer, v->base + size - sizeof(ResultsFooter), sizeof(ResultsFooter));
+
+    // Reject files whose footer doesn't describe aligned columns inside the
+    // file. Typed columns (bmi, run ends) are read through pointers, so their
+    // offsets must suit the element type; the mapping itself is page-aligned.
+    const ResultsFooter *f = &v->footer;
+    uint64_t body = size - sizeof(ResultsFooter);
+    int rle = (f->flags & RESULTS_FLAG_RLE) != 0;
+    int ok = f->magic == RESULTS_MAGIC && f->version == RESULTS_VERSION &&
+             f->rows <= UINT32_MAX && f->bmi_offset % 2 == 0 &&
+             columnFits(f->bmi_offset, f->rows * 2, body);
+    if (ok && rle) ok = f->run_offset % 4 == 0 &&
+                        columnFits(f->run_offset, (uint64_t)f->run_count * 4, body) &&
+                        columnFits(f->status_offset, (uint64_t)f->run_count * 2, body);
+    else if (ok) ok = columnFits(f->status_offset, (f->rows * 12 + 7) / 8 + 1, body);
+    if (!ok) {
+        closeResultsFile(v);
+        return 0;
+    }
+
+    v->bmi = (const uint16_t *)(v->base + f->bmi_offset);
+    v->status = v->base + f->status_offset;
+    v->run_ends = rle ? (const uint32_t *)(v->base + f->run_offset) : NULL;
+
+    // Runs must be non-empty and cover exactly rows, or lookups and counts go wrong
+    if (rle) {
+        uint32_t prev = 0;
+        for (uint32_t r = 0; ok && r < f->run_count; r++) {
+            ok = v->run_ends[r] > prev;
+            prev = v->run_ends[r];
+        }
+        ok = ok && prev == f->rows;
+    }
+    if (!ok) {
+        closeResultsFile(v);
+        return 0;
+    }
+    return 1;
+}
+
+void closeResultsFile(ResultsView *v) {
+    if (v->base) munmap((void *)v->base, v->size);
+    v->base = NULL;
+}
+
+// Decodes row i straight from the mapped columns.
+HealthData resultsRow(const ResultsView *v, size_t i) {
+    HealthData d;
+    d.bmi = v->bmi[i] / BMI_SCALE;
+
+    uint16_t code;
+    if (v->run_ends) {
+        // Binary search for the first run ending after row i
+        uint32_t lo = 0, hi = v->footer.run_count - 1;
+        while (lo < hi) {
+            uint32_t mid = (lo + hi) / 2;
+            if (v->run_ends[mid] > i) hi = mid;
+            else lo = mid + 1;
+        }
+        memcpy(&code, v->status + (size_t)lo * 2, sizeof(code));
+    } else {
+        size_t bit = i * 12;
+        const unsigned char *p = v->status + bit / 8;
+        code = ((p[0] | p[1] << 8) >> (bit % 8)) & 0xFFF;
+    }
+    unpackStatus(code, &d);
+    return d;
+}
+
+// Tallies how many rows have each status value, per field
+// (0 = BMI, 1 = BP, 2 = blood sugar, 3 = cholesterol). RLE files count whole runs at once.
+void resultsStatusCounts(const ResultsView *v, uint64_t counts[4][8]) {
+    memset(counts, 0, sizeof(uint64_t) * 4 * 8);
+    HealthData d;
+
+    if (v->run_ends) {
+        uint32_t start = 0;
+        for (uint32_t r = 0; r < v->footer.run_count; r++) {
+            uint16_t code;
+            memcpy(&code, v->status + (size_t)r * 2, sizeof(code));
+            unpackStatus(code, &d);
+            uint32_t len = v->run_ends[r] - start;
+            counts[0][d.bmi_status] += len;
+            counts[1][d.bp_status] += len;
+            counts[2][d.bs_status] += len;
+            counts[3][d.chol_status] += len;
+            start = v->run_ends[r];
+        }
+        return;
+    }
+
+    for (size_t i = 0; i < v->footer.rows; i++) {
+        d = resultsRow(v, i);
+        counts[0][d.bmi_status]++;
+        counts[1][d.bp_status]++;
+        counts[2][d.bs_status]++;
+        counts[3][d.chol_status]++;
+    }
+}
+
+// Evaluates every profile in a CSV and saves the results to results_file.
+int exportResults(const char *path, int rle) {
+    Profile* pop = NULL;
+    int count = loadPopulation(path, &pop);
+    if (count < 0) {
+        printf("Error: Could not open population file %s.\n", path);
+        return 0;
+    }
+
+    HealthData* rows = malloc((count > 0 ? count : 1) * sizeof(HealthData));
+    int ok = rows != NULL;
+    for (int i = 0; ok && i < count; i++) rows[i] = pop[i].analysis;
+    ok = ok && writeResultsFile(results_file, rows, count, rle);
+
+    free(rows);
+    free(pop);
+    if (ok) printf("\n[SUCCESS] Results for %d user(s) saved in %s\n", count, results_file);
+    else printf("Error: Could not save results file.\n");
+    return ok;
+}
+
+// Prints the status breakdown of results_file.
+int printResultsSummary(void) {
+    ResultsView v;
+    if (!openResultsFile(&v, results_file)) {
+        printf("Error: Could not read results file %s.\n", results_file);
+        return 0;
+    }
+
+    uint64_t counts[4][8];
+    resultsStatusCounts(&v, counts);
+
+    printf("\nRESULTS SUMMARY: %llu user(s)\n", (unsigned long long)v.footer.rows);
+    printf("==============================\n");
+    for (int s = 0; s < 6; s++) printf("BMI %s: %llu\n", bmi_labels[s], (unsigned long long)counts[0][s]);
+    for (int s = 0; s < 6; s++) printf("BP %s: %llu\n", bp_labels[s], (unsigned long long)counts[1][s]);
+    for (int s = 0; s < 5; s++) printf("Blood Sugar %s: %llu\n", bs_labels[s], (unsigned long long)counts[2][s]);
+    for (int s = 0; s < 3; s++) printf("Cholesterol %s: %llu\n", chol_labels[s], (unsigned long long)counts[3][s]);
+
+    closeResultsFile(&v);
+    return 1;
+}
+
 // RECOMMENDATIONS FUNCTION
 void dietAddAvoid(HealthData data, FILE *fp) {
   
@@ -623,7 +1653,31 @@ float get_valid_float(const char *prompt) {
 }
 
 // MAIN FUNCTION 
-int main() {
+int main(int argc, char *argv[]) {
+    // Batch mode: health_evaluator --rank <population.csv> <K> [threads]
+    if (argc >= 4 && strcmp(argv[1], "--rank") == 0) {
+        int threads = (argc >= 5) ? atoi(argv[4]) : 4;
+        return writeRiskRanking(argv[2], atoi(argv[3]), threads) ? 0 : 1;
+    }
+    // Batch mode: health_evaluator --group <readings.csv> <budget_mb>
+    if (argc >= 4 && strcmp(argv[1], "--group") == 0) {
+        size_t budget = (size_t)atol(argv[3]) * 1024 * 1024;
+        return groupReadings(argv[2], history_file, budget) ? 0 : 1;
+    }
+    // Batch mode: health_evaluator --store-import <population.csv>
+    if (argc >= 3 && strcmp(argv[1], "--store-import") == 0) {
+        return importToStore(argv[2]) ? 0 : 1;
+    }
+    // Batch mode: health_evaluator --export-results <population.csv> [rle]
+    if (argc >= 3 && strcmp(argv[1], "--export-results") == 0) {
+        int rle = (argc >= 4 && strcmp(argv[3], "rle") == 0);
+        return exportResults(argv[2], rle) ? 0 : 1;
+    }
+    // Batch mode: health_evaluator --results-summary
+    if (argc >= 2 && strcmp(argv[1], "--results-summary") == 0) {
+        return printResultsSummary() ? 0 : 1;
+    }
+
     Profile user;
     int exists = loadProfile(&user);
     int choice;
@@ -700,10 +1754,12 @@ int main() {
                 user.hrs
             );
 
-            saveProfile(user);
             exists = 1;
 
-            printf("\n ===== Profile saved! =====\n");
+            if (saveProfile(user))
+                printf("\n ===== Profile saved! =====\n");
+            else
+                printf("\n ===== Profile could not be saved. ===== \n");
         }
         else if (choice == 2) {
             if (!exists)